@@ -24,6 +24,9 @@ class Board
         void print(std::ostream&) const;
 
     private:
+        // Exposes the primitives below to the regression tests and microbenchmarks in test/.
+        friend struct BoardAccess;
+
         std::size_t insert(char, std::size_t);
         std::optional<std::size_t> next_available_row(std::size_t) const;
         bool winner_winner_chicken_dinner(const board_t&) const;
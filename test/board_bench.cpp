@@ -0,0 +1,118 @@
+#include "board.h"
+#include "board_reference.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Accumulates every benchmarked result so the calls cannot be optimized away.
+    volatile long long sink = 0;
+
+    //! @brief Time operation over every position, repeated until iterations calls have been made, and print ns/op.
+    //! @param name The name of the primitive being timed.
+    //! @param positions The boards to run operation on.
+    //! @param iterations The total number of calls to make.
+    //! @param operation Callable taking a board and returning a value to accumulate.
+    template <typename Operation>
+    void bench(const std::string& name, const std::vector<Board::board_t>& positions, std::size_t iterations, Operation operation)
+    {
+        long long accumulated = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+            accumulated += operation(positions[i % positions.size()]);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        sink = sink + accumulated;
+
+        double ns_per_op = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+        std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10) << ns_per_op << " ns/op\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t iterations = argc >= 2 ? std::stoul(argv[1]) : 1000000;
+    std::mt19937 rng(20231019);
+
+    // Reachable mid-game positions, skipping full boards so every position has a legal move.
+    std::vector<Board::board_t> positions;
+    std::uniform_int_distribution<std::size_t> moves(0, Board::board_rows * Board::board_columns - 1);
+    while (positions.size() < 1024)
+    {
+        auto state = reference::random_position(rng, moves(rng));
+        if (!reference::is_full(state))
+            positions.push_back(state);
+    }
+
+    Board board;
+    std::size_t column = 0;
+    auto next_column = [&](const Board::board_t& state)
+    {
+        // First non-full column at or after the rotating column index.
+        column = (column + 1) % Board::board_columns;
+        while (state[0][column] != ' ')
+            column = (column + 1) % Board::board_columns;
+        return column;
+    };
+
+    bench("next_available_row", positions, iterations, [&](const Board::board_t& state)
+    {
+        BoardAccess::state(board) = state;
+        return BoardAccess::next_available_row(board, next_column(state)).value_or(0);
+    });
+    bench("insert (in place)", positions, iterations, [&](const Board::board_t& state)
+    {
+        BoardAccess::state(board) = state;
+        return BoardAccess::insert(board, 'R', next_column(state));
+    });
+    bench("insert (copy)", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::insert(board, state, next_column(state), 'R').second;
+    });
+    bench("get_next_available_columns", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::get_next_available_columns(board, state).size();
+    });
+    bench("connected_four_horizontally", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::connected_four_horizontally(board, 3, 3, state);
+    });
+    bench("connected_four_vertically", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::connected_four_vertically(board, 3, 3, state);
+    });
+    bench("connected_four_diagonally", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::connected_four_diagonally(board, 3, 3, state);
+    });
+    bench("winner_winner_chicken_dinner", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::winner_winner_chicken_dinner(board, state);
+    });
+    bench("is_full", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::is_full(board, state);
+    });
+    bench("calculate_horizontal_score", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::calculate_horizontal_score(board, 'R', state);
+    });
+    bench("calculate_vertical_score", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::calculate_vertical_score(board, 'R', state);
+    });
+    bench("calculate_diagonal_score", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::calculate_diagonal_score(board, 'R', state);
+    });
+    bench("calculate_score", positions, iterations, [&](const Board::board_t& state)
+    {
+        return BoardAccess::calculate_score(board, 'R', state);
+    });
+
+    return 0;
+}
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "board.h"
+
+#include <array>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+//! @brief Grants the tests and benchmarks access to Board's private primitives.
+struct BoardAccess
+{
+    static Board::board_t& state(Board& board) { return board.board; }
+
+    static std::size_t insert(Board& board, char player, std::size_t column) { return board.insert(player, column); }
+    static std::pair<Board::board_t, std::size_t> insert(Board& board, const Board::board_t& state, std::size_t column, char player) { return board.insert(state, column, player); }
+    static std::optional<std::size_t> next_available_row(const Board& board, std::size_t column) { return board.next_available_row(column); }
+    static bool winner_winner_chicken_dinner(const Board& board, const Board::board_t& state) { return board.winner_winner_chicken_dinner(state); }
+    static bool connected_four_diagonally(const Board& board, std::size_t column, std::size_t row, const Board::board_t& state) { return board.connected_four_diagonally(column, row, state); }
+    static bool connected_four_vertically(const Board& board, std::size_t column, std::size_t row, const Board::board_t& state) { return board.connected_four_vertically(column, row, state); }
+    static bool connected_four_horizontally(const Board& board, std::size_t column, std::size_t row, const Board::board_t& state) { return board.connected_four_horizontally(column, row, state); }
+    static bool is_full(const Board& board, const Board::board_t& state) { return board.is_full(state); }
+    static int calculate_score(Board& board, char player, const Board::board_t& state) { return board.calculate_score(player, state); }
+    static int calculate_horizontal_score(Board& board, char player, const Board::board_t& state) { return board.calculate_horizontal_score(player, state); }
+    static int calculate_vertical_score(Board& board, char player, const Board::board_t& state) { return board.calculate_vertical_score(player, state); }
+    static int calculate_diagonal_score(Board& board, char player, const Board::board_t& state) { return board.calculate_diagonal_score(player, state); }
+    static std::vector<std::size_t> get_next_available_columns(Board& board, const Board::board_t& state) { return board.get_next_available_columns(state); }
+};
+
+//! @brief Straightforward implementations of the Board primitives, frozen at their current behavior.
+//!        Any rewrite of the primitives (bitboards, incremental evaluation, ...) must agree with these.
+namespace reference
+{
+    using board_t = Board::board_t;
+
+    constexpr std::size_t rows = Board::board_rows;
+    constexpr std::size_t columns = Board::board_columns;
+
+    //! @brief Check if a cell lies on the board.
+    //! @param row The row of the cell.
+    //! @param column The column of the cell.
+    //! @return True if the cell is on the board, false otherwise.
+    inline bool on_board(long row, long column)
+    {
+        return row >= 0 && row < static_cast<long>(rows) && column >= 0 && column < static_cast<long>(columns);
+    }
+
+    //! @brief Get the lowest empty row in column (rows grow downward).
+    //! @param state The board to check.
+    //! @param column The column to check.
+    //! @return The lowest empty row if one exists, else std::nullopt.
+    inline std::optional<std::size_t> next_available_row(const board_t& state, std::size_t column)
+    {
+        std::optional<std::size_t> available;
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            if (state[row][column] == ' ')
+                available = row;
+        }
+
+        return available;
+    }
+
+    //! @brief Check if four cells matching the cell at (row, column) line up through it along (row_step, column_step).
+    //! @param state The board to check.
+    //! @param column The column of the cell.
+    //! @param row The row of the cell.
+    //! @param row_step The row direction of the line.
+    //! @param column_step The column direction of the line.
+    //! @return True if at least four consecutive cells on the line, including the given one, match it.
+    inline bool connected_four(const board_t& state, std::size_t column, std::size_t row, int row_step, int column_step)
+    {
+        char player = state[row][column];
+        int connected = 1;
+        for (int direction : {-1, 1})
+        {
+            long r = static_cast<long>(row) + direction * row_step;
+            long c = static_cast<long>(column) + direction * column_step;
+            while (on_board(r, c) && state[r][c] == player)
+            {
+                ++connected;
+                r += direction * row_step;
+                c += direction * column_step;
+            }
+        }
+
+        return connected >= Board::connections_to_win;
+    }
+
+    inline bool connected_four_horizontally(std::size_t column, std::size_t row, const board_t& state)
+    {
+        return connected_four(state, column, row, 0, 1);
+    }
+
+    inline bool connected_four_vertically(std::size_t column, std::size_t row, const board_t& state)
+    {
+        return connected_four(state, column, row, 1, 0);
+    }
+
+    inline bool connected_four_diagonally(std::size_t column, std::size_t row, const board_t& state)
+    {
+        return connected_four(state, column, row, 1, 1) || connected_four(state, column, row, 1, -1);
+    }
+
+    //! @brief Check if any non-blank piece is part of four in a row.
+    //! @param state The board to check.
+    //! @return True if a winner exists, false otherwise.
+    inline bool winner_winner_chicken_dinner(const board_t& state)
+    {
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            for (std::size_t column = 0; column < columns; ++column)
+            {
+                if (state[row][column] != ' ' && (connected_four_horizontally(column, row, state) || connected_four_vertically(column, row, state) || connected_four_diagonally(column, row, state)))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline bool is_full(const board_t& state)
+    {
+        for (const auto& row : state)
+        {
+            for (char slot : row)
+            {
+                if (slot == ' ')
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    //! @brief Drop player into column of a copy of state.
+    //! @param state The board to copy.
+    //! @param column A non-full column.
+    //! @param player The player piece.
+    //! @return A pair containing: [first] -> the altered board and [second] -> the row the piece landed on.
+    inline std::pair<board_t, std::size_t> insert(board_t state, std::size_t column, char player)
+    {
+        std::size_t row = next_available_row(state, column).value();
+        state[row][column] = player;
+
+        return {state, row};
+    }
+
+    inline std::vector<std::size_t> get_next_available_columns(const board_t& state)
+    {
+        std::vector<std::size_t> available;
+        for (std::size_t column = 0; column < columns; ++column)
+        {
+            if (state[0][column] == ' ')
+                available.push_back(column);
+        }
+
+        return available;
+    }
+
+    inline int window_score(int player_pieces, int opponent_pieces, int blank_pieces)
+    {
+        if (player_pieces == 4)
+            return 1000;
+        if (opponent_pieces == 4)
+            return -1000;
+
+        int score = 0;
+        if (player_pieces == 3 && blank_pieces == 1)
+            score += 10;
+        else if (player_pieces == 2 && blank_pieces == 2)
+            score += 3;
+        if (opponent_pieces == 3 && blank_pieces == 1)
+            score -= 10;
+        else if (opponent_pieces == 2 && blank_pieces == 2)
+            score -= 3;
+
+        return score;
+    }
+
+    //! @brief Score the four cells starting at (row, column) and stepping by (row_step, column_step).
+    inline int score_window(char player, const board_t& state, std::size_t row, std::size_t column, int row_step, int column_step)
+    {
+        int player_pieces = 0;
+        int opponent_pieces = 0;
+        int blank_pieces = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            char slot = state[row + i * row_step][column + i * column_step];
+            if (slot == player)
+                ++player_pieces;
+            else if (slot == ' ')
+                ++blank_pieces;
+            else
+                ++opponent_pieces;
+        }
+
+        return window_score(player_pieces, opponent_pieces, blank_pieces);
+    }
+
+    inline int calculate_horizontal_score(char player, const board_t& state)
+    {
+        int score = 0;
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            for (std::size_t column = 0; column + 3 < columns; ++column)
+                score += score_window(player, state, row, column, 0, 1);
+        }
+
+        return score;
+    }
+
+    inline int calculate_vertical_score(char player, const board_t& state)
+    {
+        int score = 0;
+        for (std::size_t row = 0; row + 3 < rows; ++row)
+        {
+            for (std::size_t column = 0; column < columns; ++column)
+                score += score_window(player, state, row, column, 1, 0);
+        }
+
+        return score;
+    }
+
+    //! @brief Diagonal windows as currently scored by Board: only windows whose top row is 0 or 1,
+    //!        with top-left columns 0-2 (down-right) and top-right columns 3-6 (down-left).
+    //!        This is a subset of the 24 diagonal windows; a rewrite that scores all of them is a behavior change.
+    inline int calculate_diagonal_score(char player, const board_t& state)
+    {
+        int score = 0;
+        for (std::size_t row = 0; row < 2; ++row)
+        {
+            for (std::size_t column = 0; column < 3; ++column)
+                score += score_window(player, state, row, column, 1, 1);
+            for (std::size_t column = 3; column < columns; ++column)
+                score += score_window(player, state, row, column, 1, -1);
+        }
+
+        return score;
+    }
+
+    inline int calculate_score(char player, const board_t& state)
+    {
+        return calculate_horizontal_score(player, state) + calculate_vertical_score(player, state) + calculate_diagonal_score(player, state);
+    }
+
+    //! @brief Build a reachable position by playing random legal moves, alternating players.
+    //! @param rng The random number generator.
+    //! @param moves The number of moves to attempt (stops early if the board fills).
+    //! @return The resulting board.
+    inline board_t random_position(std::mt19937& rng, std::size_t moves)
+    {
+        board_t state;
+        for (auto& row : state)
+            row.fill(' ');
+
+        char player = 'Y';
+        for (std::size_t move = 0; move < moves; ++move)
+        {
+            auto available = get_next_available_columns(state);
+            if (available.empty())
+                break;
+
+            std::uniform_int_distribution<std::size_t> dist(0, available.size() - 1);
+            state = insert(state, available[dist(rng)], player).first;
+            player = player == 'Y' ? 'R' : 'Y';
+        }
+
+        return state;
+    }
+
+    //! @brief Build a position with every slot independently blank, 'Y', or 'R' (not necessarily reachable).
+    //! @param rng The random number generator.
+    //! @return The resulting board.
+    inline board_t random_scatter(std::mt19937& rng)
+    {
+        static const std::array<char, 3> slots = {' ', 'Y', 'R'};
+        std::uniform_int_distribution<std::size_t> dist(0, slots.size() - 1);
+
+        board_t state;
+        for (auto& row : state)
+        {
+            for (auto& slot : row)
+                slot = slots[dist(rng)];
+        }
+
+        return state;
+    }
+}
@@ -0,0 +1,180 @@
+#include "board.h"
+#include "board_reference.h"
+
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    int failures = 0;
+
+    //! @brief Record a failed check and print the board it failed on.
+    //! @param what Description of the failed check.
+    //! @param state The board the check failed on.
+    void fail(const std::string& what, const Board::board_t& state)
+    {
+        ++failures;
+        if (failures > 10)
+            return;
+
+        std::cerr << "FAIL: " << what << '\n';
+        for (const auto& row : state)
+        {
+            std::cerr << '|';
+            for (char slot : row)
+                std::cerr << slot << '|';
+            std::cerr << '\n';
+        }
+    }
+
+    template <typename T>
+    void check_equal(const T& actual, const T& expected, const std::string& what, const Board::board_t& state)
+    {
+        if (!(actual == expected))
+            fail(what, state);
+    }
+
+    //! @brief Compare every read-only primitive against the reference on the given board.
+    //! @param state The board to check.
+    //! @param reachable True if state was produced by legal moves, false otherwise.
+    void check_position(const Board::board_t& state, bool reachable)
+    {
+        Board board;
+        BoardAccess::state(board) = state;
+
+        for (std::size_t column = 0; column < Board::board_columns; ++column)
+            check_equal(BoardAccess::next_available_row(board, column), reference::next_available_row(state, column), "next_available_row(" + std::to_string(column) + ")", state);
+
+        for (std::size_t row = 0; row < Board::board_rows; ++row)
+        {
+            for (std::size_t column = 0; column < Board::board_columns; ++column)
+            {
+                std::string slot = "(" + std::to_string(column) + ", " + std::to_string(row) + ")";
+                check_equal(BoardAccess::connected_four_horizontally(board, column, row, state), reference::connected_four_horizontally(column, row, state), "connected_four_horizontally" + slot, state);
+                check_equal(BoardAccess::connected_four_vertically(board, column, row, state), reference::connected_four_vertically(column, row, state), "connected_four_vertically" + slot, state);
+                check_equal(BoardAccess::connected_four_diagonally(board, column, row, state), reference::connected_four_diagonally(column, row, state), "connected_four_diagonally" + slot, state);
+            }
+        }
+
+        check_equal(BoardAccess::winner_winner_chicken_dinner(board, state), reference::winner_winner_chicken_dinner(state), "winner_winner_chicken_dinner", state);
+        check_equal(BoardAccess::is_full(board, state), reference::is_full(state), "is_full", state);
+
+        for (char player : {'R', 'Y'})
+        {
+            std::string as = std::string(" as ") + player;
+            check_equal(BoardAccess::calculate_horizontal_score(board, player, state), reference::calculate_horizontal_score(player, state), "calculate_horizontal_score" + as, state);
+            check_equal(BoardAccess::calculate_vertical_score(board, player, state), reference::calculate_vertical_score(player, state), "calculate_vertical_score" + as, state);
+            check_equal(BoardAccess::calculate_diagonal_score(board, player, state), reference::calculate_diagonal_score(player, state), "calculate_diagonal_score" + as, state);
+            check_equal(BoardAccess::calculate_score(board, player, state), reference::calculate_score(player, state), "calculate_score" + as, state);
+        }
+
+        // The remaining primitives assume gravity holds, i.e. no gaps below a piece.
+        if (!reachable)
+            return;
+
+        check_equal(BoardAccess::get_next_available_columns(board, state), reference::get_next_available_columns(state), "get_next_available_columns", state);
+
+        for (std::size_t column : reference::get_next_available_columns(state))
+        {
+            for (char player : {'R', 'Y'})
+            {
+                std::string move = "(" + std::to_string(column) + ", " + player + ")";
+                check_equal(BoardAccess::insert(board, state, column, player), reference::insert(state, column, player), "insert" + move, state);
+
+                Board mutable_board;
+                BoardAccess::state(mutable_board) = state;
+                auto [expected_state, expected_row] = reference::insert(state, column, player);
+                check_equal(BoardAccess::insert(mutable_board, player, column), expected_row, "Board::insert" + move + " row", state);
+                check_equal(BoardAccess::state(mutable_board), expected_state, "Board::insert" + move + " state", state);
+            }
+        }
+    }
+
+    //! @brief Check that inserting into a full or out of range column throws and leaves the board untouched.
+    void check_insert_errors()
+    {
+        Board board;
+        for (std::size_t row = 0; row < Board::board_rows; ++row)
+            BoardAccess::insert(board, row % 2 == 0 ? 'Y' : 'R', 0);
+
+        auto before = BoardAccess::state(board);
+        check_equal(BoardAccess::next_available_row(board, 0), std::optional<std::size_t>(), "next_available_row on full column", before);
+
+        for (std::size_t column : {std::size_t(0), Board::board_columns, std::size_t(-1)})
+        {
+            bool threw = false;
+            try
+            {
+                BoardAccess::insert(board, 'Y', column);
+            }
+            catch (const std::runtime_error&)
+            {
+                threw = true;
+            }
+
+            check_equal(threw, true, "insert into column " + std::to_string(column) + " throws", before);
+            check_equal(BoardAccess::state(board), before, "insert into column " + std::to_string(column) + " leaves board untouched", before);
+        }
+    }
+
+    //! @brief Check wins that touch the board's edges and corners, where the unsigned loop bounds wrap.
+    void check_edge_wins()
+    {
+        Board blank;
+        Board::board_t empty = BoardAccess::state(blank);
+        const std::size_t last_row = Board::board_rows - 1;
+        const std::size_t last_column = Board::board_columns - 1;
+
+        struct line_t
+        {
+            std::size_t row;
+            std::size_t column;
+            int row_step;
+            int column_step;
+        };
+
+        for (const auto& line : {line_t{0, 0, 0, 1}, line_t{last_row, last_column, 0, -1}, line_t{0, 0, 1, 0}, line_t{last_row, last_column, -1, 0},
+                                 line_t{0, 0, 1, 1}, line_t{last_row, last_column, -1, -1}, line_t{0, last_column, 1, -1}, line_t{last_row, 0, -1, 1}})
+        {
+            auto state = empty;
+            for (int i = 0; i < Board::connections_to_win; ++i)
+                state[line.row + i * line.row_step][line.column + i * line.column_step] = 'R';
+
+            Board board;
+            check_equal(BoardAccess::winner_winner_chicken_dinner(board, state), true, "edge win detected", state);
+            check_position(state, false);
+
+            // Three in a row must not count.
+            state[line.row + 3 * line.row_step][line.column + 3 * line.column_step] = ' ';
+            check_equal(BoardAccess::winner_winner_chicken_dinner(board, state), false, "edge three is not a win", state);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t positions = argc >= 2 ? std::stoul(argv[1]) : 5000;
+    std::mt19937::result_type seed = argc >= 3 ? std::stoul(argv[2]) : 20231019;
+    std::mt19937 rng(seed);
+
+    check_insert_errors();
+    check_edge_wins();
+
+    std::uniform_int_distribution<std::size_t> moves(0, Board::board_rows * Board::board_columns);
+    for (std::size_t i = 0; i < positions; ++i)
+    {
+        check_position(reference::random_position(rng, moves(rng)), true);
+        check_position(reference::random_scatter(rng), false);
+    }
+
+    if (failures > 0)
+    {
+        std::cerr << failures << " check(s) failed (seed " << seed << ")\n";
+        return 1;
+    }
+
+    std::cout << "All checks passed on " << positions << " random positions (seed " << seed << ")\n";
+    return 0;
+}